@@ -10,6 +10,9 @@
  * 4. Different traversal methods
  * 5. Common patterns and algorithms
  * 6. Memory management techniques
+ * 7. Unrolled linked list with pooled nodes
+ * 8. Pool and arena node allocators, O(n log n) merge sort
+ * 9. Lock-free sorted list (Harris-Michael) with hazard pointers
  * 
  * =============================================================================
  */
@@ -17,8 +20,142 @@
 #include <iostream>
 #include <vector>
 #include <stack>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <type_traits>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
+// =============================================================================
+// NODE ALLOCATION - POOLS AND ARENAS
+// =============================================================================
+
+// Hands out nodes from blocks that grow geometrically and keeps freed
+// nodes on a free list, so building and tearing down a list isn't one
+// new/delete per node. Blocks are returned when the pool is destroyed.
+template<typename Node>
+class NodePool {
+private:
+    union Slot {
+        Slot* nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+    
+    vector<unique_ptr<Slot[]>> blocks;
+    Slot* freeList;
+    size_t blockUsed;
+    size_t blockSize;
+    
+public:
+    NodePool() : freeList(nullptr), blockUsed(0), blockSize(0) {}
+    
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    
+    void* allocate() {
+        Slot* slot = freeList;
+        if (slot) {
+            freeList = slot->nextFree;
+        } else {
+            if (blockUsed == blockSize) {
+                blockSize = blockSize ? min<size_t>(blockSize * 2, 65536) : 16;
+                blocks.emplace_back(new Slot[blockSize]);
+                blockUsed = 0;
+            }
+            slot = &blocks.back()[blockUsed++];
+        }
+        return slot->storage;
+    }
+    
+    void deallocate(void* node) {
+        Slot* slot = static_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+    
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        return new (allocate()) Node(std::forward<Args>(args)...);
+    }
+    
+    void destroy(Node* node) {
+        node->~Node();
+        deallocate(node);
+    }
+};
+
+// Where a list gets its nodes. Lists constructed without one use
+// new/delete. An allocator must outlive every list that uses it.
+template<typename Node>
+class NodeAllocator {
+public:
+    virtual ~NodeAllocator() = default;
+    virtual void* allocate() = 0;
+    virtual void deallocate(void* node) = 0;
+    
+    // True if deallocate() does nothing, so clear() can drop trivially
+    // destructible nodes without visiting them
+    virtual bool releasesInBulk() const { return false; }
+};
+
+// Recycles freed nodes; suits lists that grow and shrink
+template<typename Node>
+class PoolNodeAllocator : public NodeAllocator<Node> {
+private:
+    NodePool<Node> pool;
+    
+public:
+    void* allocate() override { return pool.allocate(); }
+    void deallocate(void* node) override { pool.deallocate(node); }
+};
+
+// Bump-allocates from large blocks and reclaims nothing until reset() or
+// destruction; suits lists that are built up and then thrown away whole.
+// reset() must only be called once no list holds its nodes.
+template<typename Node>
+class ArenaNodeAllocator : public NodeAllocator<Node> {
+private:
+    struct alignas(Node) Slot {
+        unsigned char storage[sizeof(Node)];
+    };
+    
+    vector<unique_ptr<Slot[]>> blocks;
+    size_t blockUsed;
+    size_t blockSize;
+    
+public:
+    ArenaNodeAllocator() : blockUsed(0), blockSize(0) {}
+    
+    void* allocate() override {
+        if (blockUsed == blockSize) {
+            blockSize = blockSize ? min<size_t>(blockSize * 2, 1 << 20) : 1024;
+            blocks.emplace_back(new Slot[blockSize]);
+            blockUsed = 0;
+        }
+        return blocks.back()[blockUsed++].storage;
+    }
+    
+    void deallocate(void*) override {}
+    bool releasesInBulk() const override { return true; }
+    
+    void reset() {
+        blocks.clear();
+        blockUsed = blockSize = 0;
+    }
+};
+
 // =============================================================================
 // SINGLY LINKED LIST - COMPLETE IMPLEMENTATION
 // =============================================================================
@@ -35,15 +172,68 @@ private:
     SinglyNode* head;
     SinglyNode* tail;
     int size;
+    NodeAllocator<SinglyNode>* allocator;
+    
+    SinglyNode* makeNode(int val) {
+        return allocator ? new (allocator->allocate()) SinglyNode(val) : new SinglyNode(val);
+    }
+    
+    void freeNode(SinglyNode* node) {
+        if (allocator) {
+            node->~SinglyNode();
+            allocator->deallocate(node);
+        } else {
+            delete node;
+        }
+    }
+    
+    // An arena reclaims its own memory, and int nodes need no destructor
+    bool canDropNodes() const {
+        static_assert(is_trivially_destructible<SinglyNode>::value, "nodes must be trivially destructible");
+        return allocator && allocator->releasesInBulk();
+    }
+    
+    // Cuts the list after count nodes and returns the rest
+    static SinglyNode* splitAfter(SinglyNode* node, int count) {
+        for (int i = 1; node && i < count; i++) {
+            node = node->next;
+        }
+        if (!node) return nullptr;
+        SinglyNode* rest = node->next;
+        node->next = nullptr;
+        return rest;
+    }
+    
+    // Appends the merge of two sorted runs after mergedTail and returns
+    // the new tail. Ties take the left node first, which keeps it stable.
+    static SinglyNode* mergeRuns(SinglyNode* left, SinglyNode* right, SinglyNode* mergedTail) {
+        while (left && right) {
+            if (right->data < left->data) {
+                mergedTail->next = right;
+                right = right->next;
+            } else {
+                mergedTail->next = left;
+                left = left->next;
+            }
+            mergedTail = mergedTail->next;
+        }
+        mergedTail->next = left ? left : right;
+        while (mergedTail->next) {
+            mergedTail = mergedTail->next;
+        }
+        return mergedTail;
+    }
 
 public:
-    SinglyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+    // Nodes come from nodeAllocator when one is given, otherwise new/delete
+    explicit SinglyLinkedList(NodeAllocator<SinglyNode>* nodeAllocator = nullptr)
+        : head(nullptr), tail(nullptr), size(0), allocator(nodeAllocator) {}
     
     ~SinglyLinkedList() { clear(); }
     
     // Different ways to insert
     void insertAtBeginning(int val) {
-        SinglyNode* newNode = new SinglyNode(val);
+        SinglyNode* newNode = makeNode(val);
         if (!head) {
             head = tail = newNode;
         } else {
@@ -55,7 +245,7 @@ public:
     }
     
     void insertAtEnd(int val) {
-        SinglyNode* newNode = new SinglyNode(val);
+        SinglyNode* newNode = makeNode(val);
         if (!head) {
             head = tail = newNode;
         } else {
@@ -82,7 +272,7 @@ public:
             return;
         }
         
-        SinglyNode* newNode = new SinglyNode(val);
+        SinglyNode* newNode = makeNode(val);
         SinglyNode* current = head;
         for (int i = 0; i < pos - 1; i++) {
             current = current->next;
@@ -101,7 +291,7 @@ public:
         }
         
         if (current) {
-            SinglyNode* newNode = new SinglyNode(val);
+            SinglyNode* newNode = makeNode(val);
             newNode->next = current->next;
             current->next = newNode;
             if (current == tail) tail = newNode;
@@ -126,7 +316,7 @@ public:
         }
         
         if (current->next) {
-            SinglyNode* newNode = new SinglyNode(val);
+            SinglyNode* newNode = makeNode(val);
             newNode->next = current->next;
             current->next = newNode;
             size++;
@@ -146,7 +336,7 @@ public:
         SinglyNode* temp = head;
         head = head->next;
         cout << "Deleted " << temp->data << " from beginning" << endl;
-        delete temp;
+        freeNode(temp);
         size--;
         
         if (!head) tail = nullptr;
@@ -160,7 +350,7 @@ public:
         
         if (head == tail) {
             cout << "Deleted " << head->data << " from end" << endl;
-            delete head;
+            freeNode(head);
             head = tail = nullptr;
         } else {
             SinglyNode* current = head;
@@ -168,7 +358,7 @@ public:
                 current = current->next;
             }
             cout << "Deleted " << tail->data << " from end" << endl;
-            delete tail;
+            freeNode(tail);
             tail = current;
             tail->next = nullptr;
         }
@@ -195,7 +385,7 @@ public:
         current->next = toDelete->next;
         if (toDelete == tail) tail = current;
         cout << "Deleted " << toDelete->data << " from position " << pos << endl;
-        delete toDelete;
+        freeNode(toDelete);
         size--;
     }
     
@@ -217,7 +407,7 @@ public:
             current->next = toDelete->next;
             if (toDelete == tail) tail = current;
             cout << "Deleted " << val << " from list" << endl;
-            delete toDelete;
+            freeNode(toDelete);
             size--;
         } else {
             cout << "Value " << val << " not found!" << endl;
@@ -237,7 +427,7 @@ public:
                 SinglyNode* toDelete = current->next;
                 current->next = toDelete->next;
                 if (toDelete == tail) tail = current;
-                delete toDelete;
+                freeNode(toDelete);
                 size--;
                 count++;
             } else {
@@ -305,6 +495,13 @@ public:
     }
     
     // Different traversal methods
+    template<typename Visitor>
+    void forEach(Visitor visit) const {
+        for (SinglyNode* current = head; current; current = current->next) {
+            visit(current->data);
+        }
+    }
+    
     void displayForward() {
         cout << "Forward: ";
         SinglyNode* current = head;
@@ -372,22 +569,27 @@ public:
         cout << "List reversed!" << endl;
     }
     
+    // Bottom-up merge sort: merges runs of width 1, 2, 4, ... by relinking
+    // nodes, so it is stable, O(n log n), and needs no recursion, copies
+    // or allocation.
     void sortList() {
         if (!head || !head->next) return;
         
-        // Simple bubble sort for demonstration
-        bool swapped;
-        do {
-            swapped = false;
-            SinglyNode* current = head;
-            while (current->next) {
-                if (current->data > current->next->data) {
-                    swap(current->data, current->next->data);
-                    swapped = true;
-                }
-                current = current->next;
+        SinglyNode dummy(0);
+        dummy.next = head;
+        SinglyNode* mergedTail = &dummy;
+        for (int width = 1; width < size; width *= 2) {
+            mergedTail = &dummy;
+            SinglyNode* current = dummy.next;
+            while (current) {
+                SinglyNode* left = current;
+                SinglyNode* right = splitAfter(left, width);
+                current = splitAfter(right, width);
+                mergedTail = mergeRuns(left, right, mergedTail);
             }
-        } while (swapped);
+        }
+        head = dummy.next;
+        tail = mergedTail;  // The last pass ends on the list's final node
         cout << "List sorted!" << endl;
     }
     
@@ -400,7 +602,7 @@ public:
                 SinglyNode* duplicate = current->next;
                 current->next = duplicate->next;
                 if (duplicate == tail) tail = current;
-                delete duplicate;
+                freeNode(duplicate);
                 size--;
             } else {
                 current = current->next;
@@ -414,12 +616,12 @@ public:
     bool isEmpty() { return size == 0; }
     
     void clear() {
-        while (head) {
+        while (head && !canDropNodes()) {
             SinglyNode* temp = head;
             head = head->next;
-            delete temp;
+            freeNode(temp);
         }
-        tail = nullptr;
+        head = tail = nullptr;
         size = 0;
     }
     
@@ -446,15 +648,37 @@ private:
     DoublyNode* head;
     DoublyNode* tail;
     int size;
+    NodeAllocator<DoublyNode>* allocator;
+    
+    DoublyNode* makeNode(int val) {
+        return allocator ? new (allocator->allocate()) DoublyNode(val) : new DoublyNode(val);
+    }
+    
+    void freeNode(DoublyNode* node) {
+        if (allocator) {
+            node->~DoublyNode();
+            allocator->deallocate(node);
+        } else {
+            delete node;
+        }
+    }
+    
+    // An arena reclaims its own memory, and int nodes need no destructor
+    bool canDropNodes() const {
+        static_assert(is_trivially_destructible<DoublyNode>::value, "nodes must be trivially destructible");
+        return allocator && allocator->releasesInBulk();
+    }
 
 public:
-    DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+    // Nodes come from nodeAllocator when one is given, otherwise new/delete
+    explicit DoublyLinkedList(NodeAllocator<DoublyNode>* nodeAllocator = nullptr)
+        : head(nullptr), tail(nullptr), size(0), allocator(nodeAllocator) {}
     
     ~DoublyLinkedList() { clear(); }
     
     // Different ways to insert
     void insertAtBeginning(int val) {
-        DoublyNode* newNode = new DoublyNode(val);
+        DoublyNode* newNode = makeNode(val);
         if (!head) {
             head = tail = newNode;
         } else {
@@ -467,7 +691,7 @@ public:
     }
     
     void insertAtEnd(int val) {
-        DoublyNode* newNode = new DoublyNode(val);
+        DoublyNode* newNode = makeNode(val);
         if (!tail) {
             head = tail = newNode;
         } else {
@@ -495,7 +719,7 @@ public:
             return;
         }
         
-        DoublyNode* newNode = new DoublyNode(val);
+        DoublyNode* newNode = makeNode(val);
         DoublyNode* current = head;
         for (int i = 0; i < pos; i++) {
             current = current->next;
@@ -524,7 +748,7 @@ public:
             tail = nullptr;
         }
         cout << "Deleted " << temp->data << " from beginning" << endl;
-        delete temp;
+        freeNode(temp);
         size--;
     }
     
@@ -542,7 +766,7 @@ public:
             head = nullptr;
         }
         cout << "Deleted " << temp->data << " from end" << endl;
-        delete temp;
+        freeNode(temp);
         size--;
     }
     
@@ -570,7 +794,7 @@ public:
         current->prev->next = current->next;
         current->next->prev = current->prev;
         cout << "Deleted " << current->data << " from position " << pos << endl;
-        delete current;
+        freeNode(current);
         size--;
     }
     
@@ -645,12 +869,12 @@ public:
     bool isEmpty() { return size == 0; }
     
     void clear() {
-        while (head) {
+        while (head && !canDropNodes()) {
             DoublyNode* temp = head;
             head = head->next;
-            delete temp;
+            freeNode(temp);
         }
-        tail = nullptr;
+        head = tail = nullptr;
         size = 0;
     }
     
@@ -676,15 +900,37 @@ private:
     CircularNode* head;
     CircularNode* tail;
     int size;
+    NodeAllocator<CircularNode>* allocator;
+    
+    CircularNode* makeNode(int val) {
+        return allocator ? new (allocator->allocate()) CircularNode(val) : new CircularNode(val);
+    }
+    
+    void freeNode(CircularNode* node) {
+        if (allocator) {
+            node->~CircularNode();
+            allocator->deallocate(node);
+        } else {
+            delete node;
+        }
+    }
+    
+    // An arena reclaims its own memory, and int nodes need no destructor
+    bool canDropNodes() const {
+        static_assert(is_trivially_destructible<CircularNode>::value, "nodes must be trivially destructible");
+        return allocator && allocator->releasesInBulk();
+    }
 
 public:
-    CircularLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+    // Nodes come from nodeAllocator when one is given, otherwise new/delete
+    explicit CircularLinkedList(NodeAllocator<CircularNode>* nodeAllocator = nullptr)
+        : head(nullptr), tail(nullptr), size(0), allocator(nodeAllocator) {}
     
     ~CircularLinkedList() { clear(); }
     
     // Different ways to insert
     void insertAtBeginning(int val) {
-        CircularNode* newNode = new CircularNode(val);
+        CircularNode* newNode = makeNode(val);
         if (!head) {
             head = tail = newNode;
             newNode->next = newNode;
@@ -698,7 +944,7 @@ public:
     }
     
     void insertAtEnd(int val) {
-        CircularNode* newNode = new CircularNode(val);
+        CircularNode* newNode = makeNode(val);
         if (!head) {
             head = tail = newNode;
             newNode->next = newNode;
@@ -727,7 +973,7 @@ public:
             return;
         }
         
-        CircularNode* newNode = new CircularNode(val);
+        CircularNode* newNode = makeNode(val);
         CircularNode* current = head;
         for (int i = 0; i < pos - 1; i++) {
             current = current->next;
@@ -748,14 +994,14 @@ public:
         
         if (head == tail) {
             cout << "Deleted " << head->data << " from beginning" << endl;
-            delete head;
+            freeNode(head);
             head = tail = nullptr;
         } else {
             CircularNode* temp = head;
             head = head->next;
             tail->next = head;
             cout << "Deleted " << temp->data << " from beginning" << endl;
-            delete temp;
+            freeNode(temp);
         }
         size--;
     }
@@ -768,7 +1014,7 @@ public:
         
         if (head == tail) {
             cout << "Deleted " << head->data << " from end" << endl;
-            delete head;
+            freeNode(head);
             head = tail = nullptr;
         } else {
             CircularNode* current = head;
@@ -776,7 +1022,7 @@ public:
                 current = current->next;
             }
             cout << "Deleted " << tail->data << " from end" << endl;
-            delete tail;
+            freeNode(tail);
             tail = current;
             tail->next = head;
         }
@@ -846,12 +1092,14 @@ public:
     void clear() {
         if (!head) return;
         
-        CircularNode* current = head;
-        do {
-            CircularNode* temp = current;
-            current = current->next;
-            delete temp;
-        } while (current != head);
+        if (!canDropNodes()) {
+            CircularNode* current = head;
+            do {
+                CircularNode* temp = current;
+                current = current->next;
+                freeNode(temp);
+            } while (current != head);
+        }
         
         head = tail = nullptr;
         size = 0;
@@ -863,6 +1111,685 @@ public:
     }
 };
 
+// =============================================================================
+// UNROLLED LINKED LIST - CACHE-FRIENDLY IMPLEMENTATION
+// =============================================================================
+
+// Each node holds a small array of elements, so traversal touches one
+// node per NodeCapacity elements instead of one per element. Nodes are
+// kept at least half full: a full node splits on insert, and a node that
+// drops below half borrows from or merges with its successor.
+template<typename T, int NodeCapacity = (sizeof(T) >= 64 ? 4 : int(256 / sizeof(T)))>
+class UnrolledLinkedList {
+private:
+    static_assert(NodeCapacity >= 2, "nodes must hold at least two elements");
+    
+    struct UnrolledNode {
+        UnrolledNode* next;
+        UnrolledNode* prev;
+        int count;
+        T items[NodeCapacity];
+        
+        UnrolledNode() : next(nullptr), prev(nullptr), count(0) {}
+    };
+    
+    NodePool<UnrolledNode> pool;
+    UnrolledNode* head;
+    UnrolledNode* tail;
+    int size;
+    int nodeCount;
+    
+    UnrolledNode* newNodeAfter(UnrolledNode* node) {
+        UnrolledNode* created = pool.create();
+        created->prev = node;
+        if (node) {
+            created->next = node->next;
+            node->next = created;
+        } else {
+            created->next = head;
+            head = created;
+        }
+        if (created->next) {
+            created->next->prev = created;
+        } else {
+            tail = created;
+        }
+        nodeCount++;
+        return created;
+    }
+    
+    void unlinkNode(UnrolledNode* node) {
+        (node->prev ? node->prev->next : head) = node->next;
+        (node->next ? node->next->prev : tail) = node->prev;
+        pool.destroy(node);
+        nodeCount--;
+    }
+    
+    // Node holding position pos (0 <= pos < size), walking from whichever
+    // end is closer; offset receives the index within that node.
+    UnrolledNode* locate(int pos, int& offset) const {
+        if (pos < size / 2) {
+            UnrolledNode* current = head;
+            while (pos >= current->count) {
+                pos -= current->count;
+                current = current->next;
+            }
+            offset = pos;
+            return current;
+        }
+        
+        int remaining = size - pos;
+        UnrolledNode* current = tail;
+        while (remaining > current->count) {
+            remaining -= current->count;
+            current = current->prev;
+        }
+        offset = current->count - remaining;
+        return current;
+    }
+    
+    void insertIntoNode(UnrolledNode* node, int offset, const T& val) {
+        if (node->count == NodeCapacity) {
+            // Split: the upper half moves to a new node after this one
+            UnrolledNode* upper = newNodeAfter(node);
+            int keep = NodeCapacity / 2;
+            move(node->items + keep, node->items + NodeCapacity, upper->items);
+            upper->count = NodeCapacity - keep;
+            node->count = keep;
+            if (offset > keep) {
+                node = upper;
+                offset -= keep;
+            }
+        }
+        move_backward(node->items + offset, node->items + node->count, node->items + node->count + 1);
+        node->items[offset] = val;
+        node->count++;
+        size++;
+    }
+    
+    void eraseFromNode(UnrolledNode* node, int offset) {
+        move(node->items + offset + 1, node->items + node->count, node->items + offset);
+        node->count--;
+        size--;
+        
+        if (node->count == 0) {
+            unlinkNode(node);
+            return;
+        }
+        
+        UnrolledNode* next = node->next;
+        if (node->count >= NodeCapacity / 2 || !next) {
+            return;
+        }
+        if (node->count + next->count <= NodeCapacity) {
+            move(next->items, next->items + next->count, node->items + node->count);
+            node->count += next->count;
+            unlinkNode(next);
+        } else {
+            int borrow = (next->count - node->count) / 2;
+            move(next->items, next->items + borrow, node->items + node->count);
+            move(next->items + borrow, next->items + next->count, next->items);
+            node->count += borrow;
+            next->count -= borrow;
+        }
+    }
+    
+    // Slides the elements drop() rejects out in one pass, refilling nodes
+    // from the front, then frees the nodes left empty at the end. Returns
+    // the number removed.
+    template<typename Drop>
+    int compact(Drop drop) {
+        UnrolledNode* writeNode = head;
+        int writeIndex = 0;
+        const T* lastKept = nullptr;
+        int kept = 0;
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (drop(node->items[i], lastKept)) {
+                    continue;
+                }
+                if (writeIndex == NodeCapacity) {
+                    writeNode->count = NodeCapacity;
+                    writeNode = writeNode->next;
+                    writeIndex = 0;
+                }
+                T& slot = writeNode->items[writeIndex++];
+                if (&slot != &node->items[i]) {
+                    slot = std::move(node->items[i]);
+                }
+                lastKept = &slot;
+                kept++;
+            }
+        }
+        
+        // Nodes were repacked even if nothing was dropped
+        int removed = size - kept;
+        if (kept == 0) {
+            clear();
+            return removed;
+        }
+        writeNode->count = writeIndex;
+        while (tail != writeNode) {
+            unlinkNode(tail);
+        }
+        size = kept;
+        return removed;
+    }
+    
+public:
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), size(0), nodeCount(0) {}
+    
+    ~UnrolledLinkedList() { clear(); }
+    
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+    
+    // Insertion
+    void insertAtBeginning(const T& val) {
+        if (!head) {
+            newNodeAfter(nullptr);
+        }
+        insertIntoNode(head, 0, val);
+    }
+    
+    void insertAtEnd(const T& val) {
+        // Appends fill the tail completely instead of splitting it
+        if (!tail || tail->count == NodeCapacity) {
+            newNodeAfter(tail);
+        }
+        tail->items[tail->count++] = val;
+        size++;
+    }
+    
+    void insertAtPosition(int pos, const T& val) {
+        if (pos < 0 || pos > size) {
+            cout << "Invalid position!" << endl;
+            return;
+        }
+        
+        if (pos == size) {
+            insertAtEnd(val);
+            return;
+        }
+        
+        int offset;
+        UnrolledNode* node = locate(pos, offset);
+        insertIntoNode(node, offset, val);
+    }
+    
+    void insertAfterValue(const T& target, const T& val) {
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == target) {
+                    insertIntoNode(node, i + 1, val);
+                    return;
+                }
+            }
+        }
+        cout << "Value " << target << " not found!" << endl;
+    }
+    
+    void insertBeforeValue(const T& target, const T& val) {
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == target) {
+                    insertIntoNode(node, i, val);
+                    return;
+                }
+            }
+        }
+        cout << "Value " << target << " not found!" << endl;
+    }
+    
+    // Deletion
+    void deleteFromBeginning() {
+        if (!head) {
+            cout << "List is empty!" << endl;
+            return;
+        }
+        eraseFromNode(head, 0);
+    }
+    
+    void deleteFromEnd() {
+        if (!tail) {
+            cout << "List is empty!" << endl;
+            return;
+        }
+        // Shrinking the tail never needs rebalancing
+        if (--tail->count == 0) {
+            unlinkNode(tail);
+        }
+        size--;
+    }
+    
+    void deleteAtPosition(int pos) {
+        if (pos < 0 || pos >= size) {
+            cout << "Invalid position!" << endl;
+            return;
+        }
+        
+        int offset;
+        UnrolledNode* node = locate(pos, offset);
+        eraseFromNode(node, offset);
+    }
+    
+    void deleteValue(const T& val) {
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == val) {
+                    eraseFromNode(node, i);
+                    return;
+                }
+            }
+        }
+        cout << "Value " << val << " not found!" << endl;
+    }
+    
+    int deleteAllOccurrences(const T& val) {
+        return compact([&](const T& item, const T*) { return item == val; });
+    }
+    
+    // Search
+    bool search(const T& val) const {
+        return findIndex(val) != -1;
+    }
+    
+    int findIndex(const T& val) const {
+        int base = 0;
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == val) return base + i;
+            }
+            base += node->count;
+        }
+        return -1;
+    }
+    
+    vector<int> findAllIndices(const T& val) const {
+        vector<int> indices;
+        int base = 0;
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                if (node->items[i] == val) indices.push_back(base + i);
+            }
+            base += node->count;
+        }
+        return indices;
+    }
+    
+    // Access
+    const T& getAt(int pos) const {
+        if (pos < 0 || pos >= size) {
+            throw out_of_range("Invalid position!");
+        }
+        int offset;
+        UnrolledNode* node = locate(pos, offset);
+        return node->items[offset];
+    }
+    
+    const T& getFirst() const {
+        if (!head) throw out_of_range("List is empty!");
+        return head->items[0];
+    }
+    
+    const T& getLast() const {
+        if (!tail) throw out_of_range("List is empty!");
+        return tail->items[tail->count - 1];
+    }
+    
+    // Traversal
+    template<typename Visitor>
+    void forEach(Visitor visit) const {
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                visit(node->items[i]);
+            }
+        }
+    }
+    
+    void displayForward() const {
+        cout << "Forward: ";
+        forEach([](const T& val) { cout << val << " "; });
+        cout << "-> NULL" << endl;
+    }
+    
+    // Manipulation
+    void reverse() {
+        for (UnrolledNode* node = head; node; node = node->prev) {
+            swap(node->next, node->prev);
+            std::reverse(node->items, node->items + node->count);
+        }
+        swap(head, tail);
+    }
+    
+    void sortList() {
+        vector<T> values;
+        values.reserve(size);
+        forEach([&](const T& val) { values.push_back(val); });
+        stable_sort(values.begin(), values.end());
+        
+        auto next = values.begin();
+        for (UnrolledNode* node = head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) {
+                node->items[i] = std::move(*next++);
+            }
+        }
+    }
+    
+    // Removes adjacent duplicates, like SinglyLinkedList::removeDuplicates
+    void removeDuplicates() {
+        compact([](const T& item, const T* lastKept) { return lastKept && *lastKept == item; });
+    }
+    
+    // Utility
+    int getSize() const { return size; }
+    bool isEmpty() const { return size == 0; }
+    
+    void clear() {
+        while (head) {
+            UnrolledNode* temp = head;
+            head = head->next;
+            pool.destroy(temp);
+        }
+        tail = nullptr;
+        size = 0;
+        nodeCount = 0;
+    }
+    
+    void printInfo() const {
+        cout << "Size: " << size << ", Nodes: " << nodeCount << " (capacity " << NodeCapacity
+             << " each, " << (nodeCount ? 100 * size / (nodeCount * NodeCapacity) : 0) << "% full)";
+        if (size) {
+            cout << ", Head: " << getFirst() << ", Tail: " << getLast();
+        }
+        cout << endl;
+    }
+};
+
+// =============================================================================
+// LOCK-FREE SORTED LIST - HARRIS-MICHAEL WITH HAZARD POINTERS
+// =============================================================================
+
+// A thread publishes the nodes it is about to dereference in its hazard
+// slots; a node removed from a shared structure is retired rather than
+// deleted, and freed only once no slot holds it. Each thread claims a
+// record on first use and gives it back when it exits; retired nodes a
+// thread leaves behind are picked up by the record's next owner.
+//
+// A publish must be visible before the reader re-checks the link it came
+// from, which normally takes a full fence per node visited. On Linux the
+// reader uses a plain store instead and scan() pays with one process-wide
+// membarrier(), which is far rarer than publishing.
+class HazardPointers {
+public:
+    static const int MaxThreads = 128;
+    static const int SlotsPerThread = 2;
+    
+    // The calling thread's slots; look them up once per operation
+    static atomic<void*>* ownSlots() {
+        return ownRecord().slots;
+    }
+    
+    static void protect(atomic<void*>& slot, void* ptr) {
+        if (asymmetricFences) {
+            slot.store(ptr, memory_order_release);
+            atomic_signal_fence(memory_order_seq_cst);
+        } else {
+            slot.store(ptr);
+        }
+    }
+    
+    static void clear() {
+        Record& record = ownRecord();
+        for (auto& slot : record.slots) {
+            slot.store(nullptr, memory_order_release);
+        }
+    }
+    
+    static void retire(void* ptr, void (*deleter)(void*)) {
+        Record& record = ownRecord();
+        record.retired.push_back({ptr, deleter});
+        if (record.retired.size() >= 2 * MaxThreads * SlotsPerThread) {
+            scan(record);
+        }
+    }
+    
+private:
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+    
+    struct alignas(64) Record {
+        atomic<bool> active{false};
+        atomic<void*> slots[SlotsPerThread] = {};
+        vector<Retired> retired;
+        
+        // Runs at program exit, when no thread can still hold a hazard
+        ~Record() {
+            for (const Retired& r : retired) {
+                r.deleter(r.ptr);
+            }
+        }
+    };
+    
+    struct ThreadRecord {
+        Record* record;
+        
+        ThreadRecord() : record(acquire()) {}
+        
+        ~ThreadRecord() {
+            for (auto& slot : record->slots) {
+                slot.store(nullptr, memory_order_release);
+            }
+            scan(*record);
+            record->active.store(false, memory_order_release);
+        }
+    };
+    
+    static Record* records() {
+        static Record table[MaxThreads];
+        return table;
+    }
+    
+    static Record* acquire() {
+        Record* table = records();
+        for (int i = 0; i < MaxThreads; i++) {
+            bool expected = false;
+            if (!table[i].active.load(memory_order_relaxed) &&
+                table[i].active.compare_exchange_strong(expected, true, memory_order_acquire)) {
+                return &table[i];
+            }
+        }
+        throw runtime_error("HazardPointers: more than MaxThreads threads");
+    }
+    
+    static Record& ownRecord() {
+        thread_local ThreadRecord own;
+        return *own.record;
+    }
+    
+    static bool registerMembarrier() {
+#ifdef __linux__
+        return syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+#else
+        return false;
+#endif
+    }
+    
+    static inline const bool asymmetricFences = registerMembarrier();
+    
+    // Frees every retired node of this record that no thread has protected
+    static void scan(Record& record) {
+#ifdef __linux__
+        if (asymmetricFences) {
+            syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+        }
+#endif
+        atomic_thread_fence(memory_order_seq_cst);
+        
+        vector<void*> hazards;
+        Record* table = records();
+        for (int i = 0; i < MaxThreads; i++) {
+            for (auto& slot : table[i].slots) {
+                if (void* ptr = slot.load()) {
+                    hazards.push_back(ptr);
+                }
+            }
+        }
+        sort(hazards.begin(), hazards.end());
+        
+        auto keep = partition(record.retired.begin(), record.retired.end(), [&](const Retired& r) {
+            return binary_search(hazards.begin(), hazards.end(), r.ptr);
+        });
+        for (auto it = keep; it != record.retired.end(); ++it) {
+            it->deleter(it->ptr);
+        }
+        record.retired.erase(keep, record.retired.end());
+    }
+};
+
+// A sorted set of ints that any number of threads can insert into,
+// remove from and search at once without locks. Removal first marks the
+// low bit of the victim's next pointer (logical delete), then unlinks it
+// with a CAS on its predecessor; any traversal that meets a marked node
+// helps unlink it. Unlinked nodes are reclaimed through HazardPointers.
+class LockFreeSortedList {
+private:
+    struct Node {
+        int key;
+        atomic<uintptr_t> next;
+        
+        explicit Node(int k) : key(k), next(0) {}
+    };
+    
+    static const uintptr_t Marked = 1;
+    
+    static Node* pointer(uintptr_t link) { return reinterpret_cast<Node*>(link & ~Marked); }
+    static bool isMarked(uintptr_t link) { return link & Marked; }
+    static uintptr_t linkTo(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+    static void deleteNode(void* node) { delete static_cast<Node*>(node); }
+    
+    atomic<uintptr_t> head;
+    
+    // Where key is or would go: the link that points at current, and the
+    // first unmarked node whose key is >= key (or null)
+    struct Window {
+        atomic<uintptr_t>* previous;
+        Node* current;
+        uintptr_t next;
+    };
+    
+    // Michael's search: walks with current and its predecessor protected
+    // by hazard pointers, unlinking marked nodes on the way. Stepping
+    // forward swaps the two slots, so each node costs one publish. A node
+    // is only trusted once the link to it is re-read unchanged after it
+    // was published; otherwise the search restarts from the head.
+    bool find(int key, Window& window) {
+    retry:
+        atomic<void*>* hazards = HazardPointers::ownSlots();
+        int currentSlot = 0, previousSlot = 1;
+        atomic<uintptr_t>* previous = &head;
+        Node* current = pointer(previous->load());
+        while (current) {
+            HazardPointers::protect(hazards[currentSlot], current);
+            if (previous->load() != linkTo(current)) goto retry;
+            
+            uintptr_t next = current->next.load();
+            if (isMarked(next)) {
+                uintptr_t expected = linkTo(current);
+                if (!previous->compare_exchange_strong(expected, next & ~Marked)) goto retry;
+                HazardPointers::retire(current, deleteNode);
+                current = pointer(next);
+                continue;
+            }
+            
+            if (current->key >= key) {
+                window = {previous, current, next};
+                return current->key == key;
+            }
+            previous = &current->next;
+            swap(currentSlot, previousSlot);
+            current = pointer(next);
+        }
+        window = {previous, nullptr, 0};
+        return false;
+    }
+
+public:
+    LockFreeSortedList() : head(0) {}
+    
+    LockFreeSortedList(const LockFreeSortedList&) = delete;
+    LockFreeSortedList& operator=(const LockFreeSortedList&) = delete;
+    
+    // Only safe once no other thread is using the list
+    ~LockFreeSortedList() {
+        Node* current = pointer(head.load());
+        while (current) {
+            Node* next = pointer(current->next.load());
+            delete current;
+            current = next;
+        }
+    }
+    
+    bool insert(int key) {
+        Node* node = new Node(key);
+        Window window;
+        while (true) {
+            if (find(key, window)) {
+                delete node;
+                HazardPointers::clear();
+                return false;
+            }
+            node->next.store(linkTo(window.current), memory_order_relaxed);
+            uintptr_t expected = linkTo(window.current);
+            if (window.previous->compare_exchange_strong(expected, linkTo(node))) {
+                HazardPointers::clear();
+                return true;
+            }
+        }
+    }
+    
+    bool remove(int key) {
+        Window window;
+        while (true) {
+            if (!find(key, window)) {
+                HazardPointers::clear();
+                return false;
+            }
+            // Whoever sets the mark owns the removal
+            uintptr_t next = window.next;
+            if (!window.current->next.compare_exchange_strong(next, next | Marked)) continue;
+            
+            uintptr_t expected = linkTo(window.current);
+            if (window.previous->compare_exchange_strong(expected, next)) {
+                HazardPointers::retire(window.current, deleteNode);
+            } else {
+                find(key, window);
+            }
+            HazardPointers::clear();
+            return true;
+        }
+    }
+    
+    bool contains(int key) {
+        Window window;
+        bool found = find(key, window);
+        HazardPointers::clear();
+        return found;
+    }
+    
+    // Only meaningful while no other thread is modifying the list
+    template<typename Visitor>
+    void forEach(Visitor visit) const {
+        for (Node* current = pointer(head.load()); current; current = pointer(current->next.load())) {
+            if (!isMarked(current->next.load())) {
+                visit(current->key);
+            }
+        }
+    }
+};
+
 // =============================================================================
 // DEMONSTRATION FUNCTIONS
 // =============================================================================
@@ -1011,6 +1938,346 @@ void demonstrateLinkedListPatterns() {
     list.displayForward();
 }
 
+void demonstrateUnrolledLinkedList() {
+    cout << "\n=== UNROLLED LINKED LIST DEMONSTRATION ===" << endl;
+    
+    // Small nodes so the splits and merges show up in a short list
+    UnrolledLinkedList<int, 4> ull;
+    
+    cout << "\n--- Insertion Methods ---" << endl;
+    for (int i = 1; i <= 10; i++) {
+        ull.insertAtEnd(i * 10);
+    }
+    ull.insertAtBeginning(5);
+    ull.insertAtPosition(3, 25);
+    ull.insertAfterValue(60, 65);
+    ull.insertBeforeValue(90, 85);
+    ull.displayForward();
+    ull.printInfo();
+    
+    cout << "\n--- Search and Access ---" << endl;
+    cout << "Search 65: " << (ull.search(65) ? "Found" : "Not found") << endl;
+    cout << "Index of 85: " << ull.findIndex(85) << endl;
+    cout << "Element at position 7: " << ull.getAt(7) << endl;
+    
+    cout << "\n--- Deletion Methods ---" << endl;
+    ull.deleteFromBeginning();
+    ull.deleteFromEnd();
+    ull.deleteAtPosition(2);
+    ull.deleteValue(65);
+    ull.displayForward();
+    ull.printInfo();
+    
+    cout << "\n--- Manipulation ---" << endl;
+    ull.reverse();
+    ull.displayForward();
+    ull.insertAtEnd(30);
+    ull.insertAtEnd(30);
+    ull.sortList();
+    ull.removeDuplicates();
+    ull.displayForward();
+    ull.printInfo();
+    
+    UnrolledLinkedList<string> words;
+    words.insertAtEnd("unrolled");
+    words.insertAtBeginning("cache-friendly");
+    words.insertAtPosition(1, "and");
+    words.displayForward();
+}
+
+void demonstrateLockFreeList() {
+    cout << "\n=== LOCK-FREE SORTED LIST DEMONSTRATION ===" << endl;
+    
+    LockFreeSortedList set;
+    cout << "\n--- Set Operations ---" << endl;
+    for (int key : {30, 10, 20, 40}) {
+        cout << "Insert " << key << ": " << (set.insert(key) ? "added" : "already present") << endl;
+    }
+    cout << "Insert 20: " << (set.insert(20) ? "added" : "already present") << endl;
+    cout << "Contains 40: " << (set.contains(40) ? "Yes" : "No") << endl;
+    cout << "Remove 10: " << (set.remove(10) ? "removed" : "not found") << endl;
+    cout << "Remove 15: " << (set.remove(15) ? "removed" : "not found") << endl;
+    cout << "Set: ";
+    set.forEach([](int key) { cout << key << " "; });
+    cout << endl;
+    
+    // Every thread tallies its successful inserts minus removes per key;
+    // afterwards each key must be present exactly when its tally is 1
+    cout << "\n--- Stress Test ---" << endl;
+    const int threads = 8, opsPerThread = 200000, keyRange = 64;
+    LockFreeSortedList shared;
+    vector<vector<int>> tallies(threads, vector<int>(keyRange, 0));
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(100 + t);
+            for (int i = 0; i < opsPerThread; i++) {
+                int key = int(rng() % keyRange);
+                switch (rng() % 3) {
+                    case 0: tallies[t][key] += shared.insert(key); break;
+                    case 1: tallies[t][key] -= shared.remove(key); break;
+                    default: shared.contains(key); break;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    vector<int> present(keyRange, 0);
+    int previous = -1;
+    bool ordered = true;
+    shared.forEach([&](int key) {
+        ordered = ordered && key > previous;
+        previous = key;
+        present[key]++;
+    });
+    int mismatches = 0;
+    for (int key = 0; key < keyRange; key++) {
+        int tally = 0;
+        for (int t = 0; t < threads; t++) {
+            tally += tallies[t][key];
+        }
+        mismatches += (tally != present[key]);
+    }
+    cout << threads << " threads x " << opsPerThread << " random ops on " << keyRange << " keys: "
+         << (ordered && mismatches == 0 ? "consistent" : "INCONSISTENT") << " ("
+         << count(present.begin(), present.end(), 1) << " keys present)" << endl;
+}
+
+// The list classes above report every operation on cout; benchmarks turn
+// that off so they time the list, not the console.
+struct QuietOutput {
+    QuietOutput() { cout.setstate(ios::badbit); }
+    ~QuietOutput() { cout.clear(); }
+};
+
+double elapsedMs(chrono::steady_clock::time_point since) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - since).count();
+}
+
+// Builds a list of n elements, then times a full scan (search for a
+// missing value), and positional inserts and deletes at random positions.
+// CircularLinkedList has no deleteAtPosition, so it skips the delete pass.
+template<typename List>
+void benchmarkList(const string& name, int n) {
+    constexpr bool hasDelete = !is_same<List, CircularLinkedList>::value;
+    const int ops = 50;
+    mt19937 rng(42);
+    double buildMs, scanNs, insertUs, deleteUs = 0;
+    bool found;
+    {
+        QuietOutput quiet;
+        List list;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < n; i++) {
+            list.insertAtEnd(i);
+        }
+        buildMs = elapsedMs(start);
+        
+        int scans = max(1, 10000000 / n);
+        start = chrono::steady_clock::now();
+        found = false;
+        for (int s = 0; s < scans; s++) {
+            found |= list.search(-1);
+        }
+        scanNs = elapsedMs(start) * 1e6 / (double(scans) * n);
+        
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < ops; i++) {
+            list.insertAtPosition(int(rng() % (list.getSize() + 1)), -2);
+        }
+        insertUs = elapsedMs(start) * 1000 / ops;
+        
+        if constexpr (hasDelete) {
+            start = chrono::steady_clock::now();
+            for (int i = 0; i < ops; i++) {
+                list.deleteAtPosition(int(rng() % list.getSize()));
+            }
+            deleteUs = elapsedMs(start) * 1000 / ops;
+        }
+    }
+    
+    cout << "  " << left << setw(10) << name << right << fixed << setprecision(2)
+         << setw(10) << buildMs << " ms build" << setw(8) << scanNs << " ns/elem scan"
+         << setw(12) << insertUs << " us/insert";
+    if (hasDelete) {
+        cout << setw(12) << deleteUs << " us/delete";
+    }
+    cout << (found ? " (scan error)" : "") << defaultfloat << endl;
+}
+
+// SinglyLinkedList behind one mutex, used as a set to compare against
+// LockFreeSortedList
+class LockedListSet {
+private:
+    mutex lock;
+    SinglyLinkedList list;
+    
+public:
+    bool insert(int key) {
+        lock_guard<mutex> guard(lock);
+        if (list.search(key)) return false;
+        list.insertAtEnd(key);
+        return true;
+    }
+    
+    bool remove(int key) {
+        lock_guard<mutex> guard(lock);
+        if (!list.search(key)) return false;
+        list.deleteValue(key);
+        return true;
+    }
+    
+    bool contains(int key) {
+        lock_guard<mutex> guard(lock);
+        return list.search(key);
+    }
+};
+
+// Runs a 10% insert / 10% remove / 80% contains mix on random keys from
+// every thread for the given time; returns millions of operations per second
+template<typename Set>
+double measureSetThroughput(Set& set, int threads, int keyRange, int durationMs) {
+    atomic<bool> start(false), stop(false);
+    atomic<long long> totalOps(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(t + 1);
+            long long ops = 0;
+            while (!start.load()) {
+                this_thread::yield();
+            }
+            while (!stop.load(memory_order_relaxed)) {
+                for (int i = 0; i < 64; i++) {
+                    int key = int(rng() % keyRange);
+                    int op = int(rng() % 10);
+                    if (op == 0) {
+                        set.insert(key);
+                    } else if (op == 1) {
+                        set.remove(key);
+                    } else {
+                        set.contains(key);
+                    }
+                }
+                ops += 64;
+            }
+            totalOps += ops;
+        });
+    }
+    
+    auto begin = chrono::steady_clock::now();
+    start = true;
+    this_thread::sleep_for(chrono::milliseconds(durationMs));
+    stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return totalOps / elapsedMs(begin) / 1000;
+}
+
+void benchmarkConcurrentLists() {
+    cout << "\n=== CONCURRENT LIST BENCHMARK ===" << endl;
+    const int keyRange = 1024;
+    cout << keyRange << " keys, half present; 80% contains, 10% insert, 10% remove ("
+         << thread::hardware_concurrency() << " hardware threads)" << endl;
+    
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        double lockedOps, lockFreeOps;
+        {
+            QuietOutput quiet;
+            LockedListSet locked;
+            for (int key = 0; key < keyRange; key += 2) {
+                locked.insert(key);
+            }
+            lockedOps = measureSetThroughput(locked, threads, keyRange, 200);
+        }
+        {
+            LockFreeSortedList lockFree;
+            for (int key = 0; key < keyRange; key += 2) {
+                lockFree.insert(key);
+            }
+            lockFreeOps = measureSetThroughput(lockFree, threads, keyRange, 200);
+        }
+        cout << "  " << setw(2) << threads << " threads:" << fixed << setprecision(2)
+             << setw(8) << lockedOps << " Mops/s mutex + SinglyLinkedList"
+             << setw(8) << lockFreeOps << " Mops/s lock-free (" << lockFreeOps / lockedOps << "x)"
+             << defaultfloat << endl;
+    }
+}
+
+// Build, sort and clear a SinglyLinkedList of random values with each
+// kind of node allocation
+void benchmarkAllocator(const string& name, NodeAllocator<SinglyNode>* allocator,
+                        const vector<int>& values, const vector<int>& sorted) {
+    double buildMs, sortMs, clearMs;
+    bool ok = true;
+    {
+        QuietOutput quiet;
+        SinglyLinkedList list(allocator);
+        auto start = chrono::steady_clock::now();
+        for (int val : values) {
+            list.insertAtEnd(val);
+        }
+        buildMs = elapsedMs(start);
+        
+        start = chrono::steady_clock::now();
+        list.sortList();
+        sortMs = elapsedMs(start);
+        
+        size_t i = 0;
+        list.forEach([&](int val) { ok = ok && i < sorted.size() && sorted[i++] == val; });
+        ok = ok && i == sorted.size() && list.getLast() == sorted.back();
+        
+        start = chrono::steady_clock::now();
+        list.clear();
+        clearMs = elapsedMs(start);
+    }
+    
+    cout << "  " << left << setw(12) << name << right << fixed << setprecision(2)
+         << setw(10) << buildMs << " ms build" << setw(10) << sortMs << " ms sort"
+         << setw(10) << clearMs << " ms clear" << (ok ? "" : " (NOT SORTED)") << defaultfloat << endl;
+}
+
+void benchmarkListAllocation() {
+    cout << "\n=== LIST ALLOCATION AND SORT BENCHMARK ===" << endl;
+    for (int n : {100000, 1000000}) {
+        mt19937 rng(7);
+        vector<int> values(n);
+        for (int& val : values) {
+            val = int(rng() % n);
+        }
+        vector<int> sorted = values;
+        sort(sorted.begin(), sorted.end());
+        
+        cout << n << " random elements in a SinglyLinkedList:" << endl;
+        // new/delete goes last: its million freed nodes make the next large
+        // malloc consolidate the heap, which would be charged to the pool
+        {
+            PoolNodeAllocator<SinglyNode> pool;
+            benchmarkAllocator("Pool", &pool, values, sorted);
+        }
+        {
+            ArenaNodeAllocator<SinglyNode> arena;
+            benchmarkAllocator("Arena", &arena, values, sorted);
+        }
+        benchmarkAllocator("new/delete", nullptr, values, sorted);
+    }
+}
+
+void benchmarkListLayouts() {
+    cout << "\n=== LIST LAYOUT BENCHMARK ===" << endl;
+    for (int n : {1000, 100000, 1000000, 10000000}) {
+        cout << n << " elements:" << endl;
+        benchmarkList<SinglyLinkedList>("Singly", n);
+        benchmarkList<DoublyLinkedList>("Doubly", n);
+        benchmarkList<CircularLinkedList>("Circular", n);
+        benchmarkList<UnrolledLinkedList<int>>("Unrolled", n);
+    }
+}
+
 // =============================================================================
 // MAIN FUNCTION
 // =============================================================================
@@ -1022,12 +2289,19 @@ int main() {
     demonstrateDoublyLinkedList();
     demonstrateCircularLinkedList();
     demonstrateLinkedListPatterns();
+    demonstrateUnrolledLinkedList();
+    demonstrateLockFreeList();
+    benchmarkListLayouts();
+    benchmarkListAllocation();
+    benchmarkConcurrentLists();
     
     cout << "\n=== SUMMARY ===" << endl;
     cout << "1. Singly Linked List: Simple, memory efficient, one-way traversal" << endl;
     cout << "2. Doubly Linked List: Two-way traversal, more memory usage" << endl;
     cout << "3. Circular Linked List: Last node connects to first, useful for round-robin" << endl;
-    cout << "4. Each has different use cases and trade-offs" << endl;
+    cout << "4. Unrolled Linked List: Small arrays per node, far fewer cache misses per element" << endl;
+    cout << "5. Lock-Free Sorted List: Concurrent set, marked links, hazard-pointer reclamation" << endl;
+    cout << "6. Each has different use cases and trade-offs" << endl;
     
     return 0;
 } 
\ No newline at end of file
@@ -4,11 +4,11 @@
  * =============================================================================
  * 
  * This file covers:
- * 1. Array-based Stack implementation
+ * 1. Array-based Stack implementation (inline small buffer, move-aware growth)
  * 2. Linked List-based Stack implementation
  * 3. STL Stack operations
  * 4. Different ways to use stack
- * 5. Stack applications and algorithms
+ * 5. Stack applications and algorithms (single-pass expression engine)
  * 6. Common patterns and problems
  * 
  * =============================================================================
@@ -20,76 +20,223 @@
 #include <string>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <string_view>
+#include <unordered_map>
+#include <charconv>
+#include <chrono>
 using namespace std;
 
 // =============================================================================
 // ARRAY-BASED STACK IMPLEMENTATION
 // =============================================================================
 
-template<typename T>
+// The first InlineCapacity elements live inside the stack object itself,
+// so small stacks never touch the allocator. Past that, elements move to
+// a heap buffer that doubles when full. Growing relocates elements with
+// memcpy when T is trivially copyable and by move construction otherwise.
+template<typename T, int InlineCapacity = 16>
 class ArrayStack {
 private:
+    static_assert(InlineCapacity > 0, "InlineCapacity must be positive");
+    
+    alignas(T) unsigned char inline_buffer[InlineCapacity * sizeof(T)];
     T* data;
     int capacity;
     int top_index;
     
-    void resize() {
+    T* inlineData() { return reinterpret_cast<T*>(inline_buffer); }
+    bool usesInlineBuffer() const { return data == reinterpret_cast<const T*>(inline_buffer); }
+    
+    static T* allocate(int count) {
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+    
+    void releaseHeapBuffer() {
+        if (!usesInlineBuffer()) {
+            ::operator delete(data);
+        }
+        data = inlineData();
+        capacity = InlineCapacity;
+    }
+    
+    // Moves count elements from src into uninitialized dst and ends the
+    // lifetime of the originals. The originals are only destroyed once
+    // every element is built; if a construction throws, the ones built so
+    // far are destroyed. Growth leaves src untouched in that case
+    // (move_if_noexcept copies when moving could throw); moving the whole
+    // stack always moves, since the source is being given up anyway.
+    template<bool AlwaysMove = false>
+    static void relocate(T* src, int count, T* dst) {
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (count > 0) {
+                memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            }
+        } else {
+            int built = 0;
+            try {
+                for (; built < count; built++) {
+                    if constexpr (AlwaysMove) {
+                        new (dst + built) T(std::move(src[built]));
+                    } else {
+                        new (dst + built) T(move_if_noexcept(src[built]));
+                    }
+                }
+            } catch (...) {
+                while (built > 0) {
+                    dst[--built].~T();
+                }
+                throw;
+            }
+            for (int i = 0; i < count; i++) {
+                src[i].~T();
+            }
+        }
+    }
+    
+    void destroyAll() {
+        if constexpr (!is_trivially_destructible<T>::value) {
+            for (int i = top_index; i >= 0; i--) {
+                data[i].~T();
+            }
+        }
+        top_index = -1;
+    }
+    
+    void copyFrom(const ArrayStack& other) {
+        if (other.size() > capacity) {
+            data = allocate(other.capacity);
+            capacity = other.capacity;
+        }
+        for (int i = 0; i <= other.top_index; i++) {
+            new (data + i) T(other.data[i]);
+            top_index = i;
+        }
+    }
+    
+    // Takes other's heap buffer if it has one, otherwise moves its
+    // elements one by one; other is left empty either way
+    void moveFrom(ArrayStack& other) {
+        if (other.usesInlineBuffer()) {
+            relocate<true>(other.data, other.size(), data);
+            top_index = other.top_index;
+        } else {
+            data = other.data;
+            capacity = other.capacity;
+            top_index = other.top_index;
+            other.data = other.inlineData();
+            other.capacity = InlineCapacity;
+        }
+        other.top_index = -1;
+    }
+    
+    // Builds the new element in the new buffer before relocating the old
+    // ones, so emplacing a copy of an element already on the stack works.
+    // If anything throws, the stack is left as it was.
+    template<typename... Args>
+    T& growAndEmplace(Args&&... args) {
         int new_capacity = capacity * 2;
-        T* new_data = new T[new_capacity];
-        for (int i = 0; i <= top_index; i++) {
-            new_data[i] = data[i];
+        T* new_data = allocate(new_capacity);
+        T* slot = new_data + top_index + 1;
+        try {
+            new (slot) T(std::forward<Args>(args)...);
+            try {
+                relocate(data, top_index + 1, new_data);
+            } catch (...) {
+                slot->~T();
+                throw;
+            }
+        } catch (...) {
+            ::operator delete(new_data);
+            throw;
         }
-        delete[] data;
+        releaseHeapBuffer();
         data = new_data;
         capacity = new_capacity;
         cout << "Stack resized to capacity: " << capacity << endl;
+        return data[++top_index];
     }
 
 public:
     // Constructor
-    ArrayStack(int initial_capacity = 10) 
-        : capacity(initial_capacity), top_index(-1) {
-        data = new T[capacity];
+    ArrayStack(int initial_capacity = InlineCapacity) 
+        : data(inlineData()), capacity(InlineCapacity), top_index(-1) {
+        if (initial_capacity > InlineCapacity) {
+            data = allocate(initial_capacity);
+            capacity = initial_capacity;
+        }
         cout << "Array stack created with capacity: " << capacity << endl;
     }
     
     // Destructor
     ~ArrayStack() {
-        delete[] data;
+        destroyAll();
+        releaseHeapBuffer();
         cout << "Array stack destroyed" << endl;
     }
     
     // Copy constructor
     ArrayStack(const ArrayStack& other) 
-        : capacity(other.capacity), top_index(other.top_index) {
-        data = new T[capacity];
-        for (int i = 0; i <= top_index; i++) {
-            data[i] = other.data[i];
+        : data(inlineData()), capacity(InlineCapacity), top_index(-1) {
+        try {
+            copyFrom(other);
+        } catch (...) {
+            destroyAll();
+            releaseHeapBuffer();
+            throw;
         }
         cout << "Array stack copied" << endl;
     }
     
-    // Assignment operator
+    // Move constructor
+    ArrayStack(ArrayStack&& other) noexcept(is_nothrow_move_constructible<T>::value)
+        : data(inlineData()), capacity(InlineCapacity), top_index(-1) {
+        moveFrom(other);
+        cout << "Array stack moved" << endl;
+    }
+    
+    // Assignment operators
     ArrayStack& operator=(const ArrayStack& other) {
         if (this != &other) {
-            delete[] data;
-            capacity = other.capacity;
-            top_index = other.top_index;
-            data = new T[capacity];
-            for (int i = 0; i <= top_index; i++) {
-                data[i] = other.data[i];
-            }
+            destroyAll();
+            releaseHeapBuffer();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    
+    ArrayStack& operator=(ArrayStack&& other) noexcept(is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            destroyAll();
+            releaseHeapBuffer();
+            moveFrom(other);
         }
         return *this;
     }
     
     // Basic operations
     void push(const T& value) {
+        T& pushed = emplace(value);
+        cout << "Pushed " << pushed << " to array stack" << endl;
+    }
+    
+    void push(T&& value) {
+        T& pushed = emplace(std::move(value));
+        cout << "Pushed " << pushed << " to array stack" << endl;
+    }
+    
+    // Constructs the new top element in place from args
+    template<typename... Args>
+    T& emplace(Args&&... args) {
         if (top_index >= capacity - 1) {
-            resize();
+            return growAndEmplace(std::forward<Args>(args)...);
         }
-        data[++top_index] = value;
-        cout << "Pushed " << value << " to array stack" << endl;
+        new (data + top_index + 1) T(std::forward<Args>(args)...);
+        return data[++top_index];
     }
     
     void pop() {
@@ -98,7 +245,7 @@ public:
             return;
         }
         cout << "Popped " << data[top_index] << " from array stack" << endl;
-        top_index--;
+        data[top_index--].~T();
     }
     
     T& top() {
@@ -119,6 +266,7 @@ public:
     bool isEmpty() const { return top_index == -1; }
     int size() const { return top_index + 1; }
     int getCapacity() const { return capacity; }
+    bool isInline() const { return usesInlineBuffer(); }
     
     // Display methods
     void display() const {
@@ -146,7 +294,7 @@ public:
     
     // Advanced operations
     void clear() {
-        top_index = -1;
+        destroyAll();
         cout << "Array stack cleared" << endl;
     }
     
@@ -159,6 +307,7 @@ public:
     
     void printInfo() const {
         cout << "Array Stack Info - Size: " << size() << ", Capacity: " << capacity 
+             << (isInline() ? " (inline)" : " (heap)")
              << ", Top: " << (isEmpty() ? "Empty" : to_string(top())) << endl;
     }
 };
@@ -569,6 +718,354 @@ public:
     }
 };
 
+// =============================================================================
+// EXPRESSION ENGINE - SINGLE-PASS SHUNTING-YARD WITH BYTECODE
+// =============================================================================
+
+enum class ExprOp : unsigned char {
+    Constant, Variable, Negate, Add, Subtract, Multiply, Divide, Modulo, Power
+};
+
+inline double applyBinary(ExprOp op, double a, double b) {
+    switch (op) {
+        case ExprOp::Add: return a + b;
+        case ExprOp::Subtract: return a - b;
+        case ExprOp::Multiply: return a * b;
+        case ExprOp::Divide: return a / b;
+        case ExprOp::Modulo: return fmod(a, b);
+        case ExprOp::Power: return pow(a, b);
+        default: throw logic_error("applyBinary: not a binary operator");
+    }
+}
+
+// An expression compiled to postfix bytecode for a small stack machine.
+// Variables are numbered in order of first appearance, so evaluation
+// takes their values as a plain array and never looks up a name.
+// Constant subexpressions are folded while compiling.
+class CompiledExpression {
+private:
+    struct Instruction {
+        ExprOp op;
+        int slot;
+        double value;
+    };
+    
+    static const int InlineStackDepth = 32;
+    
+    vector<Instruction> code;
+    vector<string> variable_names;
+    int depth = 0;
+    int max_depth = 0;
+    
+    friend class ExpressionEngine;
+    
+    // Called by ExpressionEngine::parse as operands and operators come out
+    // of the shunting-yard in postfix order
+    void constant(double value) {
+        code.push_back({ExprOp::Constant, -1, value});
+        max_depth = max(max_depth, ++depth);
+    }
+    
+    void variable(string_view name) {
+        int slot = slotOf(name);
+        if (slot < 0) {
+            slot = int(variable_names.size());
+            variable_names.emplace_back(name);
+        }
+        code.push_back({ExprOp::Variable, slot, 0});
+        max_depth = max(max_depth, ++depth);
+    }
+    
+    void op(ExprOp op) {
+        size_t n = code.size();
+        if (op == ExprOp::Negate) {
+            if (code[n - 1].op == ExprOp::Constant) {
+                code[n - 1].value = -code[n - 1].value;
+            } else {
+                code.push_back({op, -1, 0});
+            }
+            return;
+        }
+        
+        depth--;
+        if (code[n - 1].op == ExprOp::Constant && code[n - 2].op == ExprOp::Constant) {
+            code[n - 2].value = applyBinary(op, code[n - 2].value, code[n - 1].value);
+            code.pop_back();
+        } else {
+            code.push_back({op, -1, 0});
+        }
+    }
+
+public:
+    // values[i] is the value of variables()[i]
+    double evaluate(const double* values) const {
+        if (code.empty()) {
+            throw logic_error("CompiledExpression is empty");
+        }
+        double inline_stack[InlineStackDepth];
+        vector<double> heap_stack;
+        double* stack = inline_stack;
+        if (max_depth > InlineStackDepth) {
+            heap_stack.resize(max_depth);
+            stack = heap_stack.data();
+        }
+        
+        int top = -1;
+        for (const Instruction& instruction : code) {
+            switch (instruction.op) {
+                case ExprOp::Constant: stack[++top] = instruction.value; break;
+                case ExprOp::Variable: stack[++top] = values[instruction.slot]; break;
+                case ExprOp::Negate: stack[top] = -stack[top]; break;
+                case ExprOp::Add: top--; stack[top] += stack[top + 1]; break;
+                case ExprOp::Subtract: top--; stack[top] -= stack[top + 1]; break;
+                case ExprOp::Multiply: top--; stack[top] *= stack[top + 1]; break;
+                case ExprOp::Divide: top--; stack[top] /= stack[top + 1]; break;
+                case ExprOp::Modulo: top--; stack[top] = fmod(stack[top], stack[top + 1]); break;
+                case ExprOp::Power: top--; stack[top] = pow(stack[top], stack[top + 1]); break;
+            }
+        }
+        return stack[0];
+    }
+    
+    double evaluate(const vector<double>& values) const {
+        if (values.size() < variable_names.size()) {
+            throw invalid_argument("Expected " + to_string(variable_names.size()) + " variable values");
+        }
+        return evaluate(values.data());
+    }
+    
+    const vector<string>& variables() const { return variable_names; }
+    
+    int slotOf(string_view name) const {
+        for (size_t i = 0; i < variable_names.size(); i++) {
+            if (variable_names[i] == name) return int(i);
+        }
+        return -1;
+    }
+    
+    int instructionCount() const { return int(code.size()); }
+};
+
+// Supports decimal and floating-point literals (1, 2.5, .5, 6.02e23),
+// variables ([A-Za-z_][A-Za-z0-9_]*), parentheses, unary + and -, and
+// + - * / % ^. ^ is right-associative and binds tighter than unary
+// minus, so -2^2 is -4. Malformed input throws runtime_error naming the
+// position.
+class ExpressionEngine {
+private:
+    // Parsing scratch space: the first 32 entries live on the call stack
+    // and deeper expressions spill to the heap, so typical expressions
+    // parse without allocating
+    template<typename T>
+    class ScratchStack {
+    private:
+        T inline_items[32];
+        vector<T> spill;
+        T* items = inline_items;
+        int capacity = 32;
+        int count = 0;
+        
+    public:
+        ScratchStack() = default;
+        ScratchStack(const ScratchStack&) = delete;
+        ScratchStack& operator=(const ScratchStack&) = delete;
+        
+        // Takes value by copy so pushing top() survives the buffer moving
+        void push(T value) {
+            if (count == capacity) {
+                if (items == inline_items) {
+                    spill.assign(inline_items, inline_items + count);
+                }
+                spill.resize(capacity * 2);
+                items = spill.data();
+                capacity *= 2;
+            }
+            items[count++] = value;
+        }
+        
+        void pop() { count--; }
+        T& top() { return items[count - 1]; }
+        bool empty() const { return count == 0; }
+    };
+    
+    struct PendingOp {
+        ExprOp op;
+        int precedence;     // 0 marks an open parenthesis
+        bool right_associative;
+    };
+    
+    static bool binaryOperator(char c, PendingOp& pending) {
+        switch (c) {
+            case '+': pending = {ExprOp::Add, 1, false}; return true;
+            case '-': pending = {ExprOp::Subtract, 1, false}; return true;
+            case '*': pending = {ExprOp::Multiply, 2, false}; return true;
+            case '/': pending = {ExprOp::Divide, 2, false}; return true;
+            case '%': pending = {ExprOp::Modulo, 2, false}; return true;
+            case '^': pending = {ExprOp::Power, 4, true}; return true;
+            default: return false;
+        }
+    }
+    
+    static runtime_error syntaxError(const string& what, size_t pos) {
+        return runtime_error(what + " at position " + to_string(pos));
+    }
+    
+    static double parseNumber(string_view expr, size_t& i) {
+        size_t start = i;
+        auto digits = [&]() {
+            while (i < expr.size() && isdigit(static_cast<unsigned char>(expr[i]))) i++;
+        };
+        digits();
+        
+        // Short integers, the common case, are exact in a double and
+        // don't need the general conversion
+        bool fraction_follows = i < expr.size() && (expr[i] == '.' || expr[i] == 'e' || expr[i] == 'E');
+        if (!fraction_follows && i - start <= 15) {
+            double value = 0;
+            for (size_t d = start; d < i; d++) {
+                value = value * 10 + (expr[d] - '0');
+            }
+            return value;
+        }
+        
+        if (i < expr.size() && expr[i] == '.') {
+            i++;
+            digits();
+        }
+        if (i < expr.size() && (expr[i] == 'e' || expr[i] == 'E')) {
+            size_t mark = i++;
+            if (i < expr.size() && (expr[i] == '+' || expr[i] == '-')) i++;
+            size_t exponent = i;
+            digits();
+            if (i == exponent) i = mark;    // not an exponent; leave the 'e' unread
+        }
+        
+        double value = 0;
+        auto result = from_chars(expr.data() + start, expr.data() + i, value);
+        if (result.ec != errc() || result.ptr != expr.data() + i) {
+            throw syntaxError("Invalid number '" + string(expr.substr(start, i - start)) + "'", start);
+        }
+        return value;
+    }
+
+public:
+    // Tokenizes and parses expr in a single pass. Operands go straight to
+    // the sink and operators are held on a stack until the shunting-yard
+    // releases them, so the sink sees the expression in postfix order:
+    // sink.constant(double), sink.variable(string_view), sink.op(ExprOp).
+    template<typename Sink>
+    static void parse(string_view expr, Sink& sink) {
+        ScratchStack<PendingOp> ops;
+        bool expect_operand = true;
+        size_t i = 0;
+        
+        auto release = [&](int precedence, bool right_associative) {
+            while (!ops.empty() && ops.top().precedence != 0 &&
+                   (ops.top().precedence > precedence ||
+                    (ops.top().precedence == precedence && !right_associative))) {
+                sink.op(ops.top().op);
+                ops.pop();
+            }
+        };
+        
+        while (true) {
+            while (i < expr.size() && isspace(static_cast<unsigned char>(expr[i]))) i++;
+            if (i == expr.size()) break;
+            char c = expr[i];
+            
+            if (expect_operand) {
+                if (isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                    sink.constant(parseNumber(expr, i));
+                    expect_operand = false;
+                } else if (isalpha(static_cast<unsigned char>(c)) || c == '_') {
+                    size_t start = i;
+                    while (i < expr.size() && (isalnum(static_cast<unsigned char>(expr[i])) || expr[i] == '_')) i++;
+                    sink.variable(expr.substr(start, i - start));
+                    expect_operand = false;
+                } else if (c == '(') {
+                    ops.push({ExprOp::Constant, 0, false});
+                    i++;
+                } else if (c == '-') {
+                    ops.push({ExprOp::Negate, 3, true});
+                    i++;
+                } else if (c == '+') {
+                    i++;
+                } else {
+                    throw syntaxError(string("Expected a number, variable or '(' but found '") + c + "'", i);
+                }
+                continue;
+            }
+            
+            PendingOp pending;
+            if (c == ')') {
+                release(0, false);
+                if (ops.empty()) {
+                    throw syntaxError("Unmatched ')'", i);
+                }
+                ops.pop();
+            } else if (binaryOperator(c, pending)) {
+                release(pending.precedence, pending.right_associative);
+                ops.push(pending);
+                expect_operand = true;
+            } else {
+                throw syntaxError(string("Expected an operator or ')' but found '") + c + "'", i);
+            }
+            i++;
+        }
+        
+        if (expect_operand) {
+            throw syntaxError("Expression ends where an operand was expected", i);
+        }
+        release(0, false);
+        if (!ops.empty()) {
+            throw syntaxError("Unmatched '('", expr.size());
+        }
+    }
+    
+    // Evaluates while parsing; for one-off expressions
+    static double evaluate(string_view expr, const unordered_map<string, double>& variables) {
+        struct Evaluator {
+            const unordered_map<string, double>& variables;
+            ScratchStack<double> values;
+            
+            void constant(double value) { values.push(value); }
+            
+            void variable(string_view name) {
+                auto it = variables.find(string(name));
+                if (it == variables.end()) {
+                    throw runtime_error("Unknown variable '" + string(name) + "'");
+                }
+                values.push(it->second);
+            }
+            
+            void op(ExprOp op) {
+                if (op == ExprOp::Negate) {
+                    values.top() = -values.top();
+                    return;
+                }
+                double b = values.top();
+                values.pop();
+                values.top() = applyBinary(op, values.top(), b);
+            }
+        } evaluator{variables, {}};
+        
+        parse(expr, evaluator);
+        return evaluator.values.top();
+    }
+    
+    static double evaluate(string_view expr) {
+        static const unordered_map<string, double> no_variables;
+        return evaluate(expr, no_variables);
+    }
+    
+    // Parses once into bytecode for expressions evaluated many times
+    static CompiledExpression compile(string_view expr) {
+        CompiledExpression compiled;
+        parse(expr, compiled);
+        return compiled;
+    }
+};
+
 // =============================================================================
 // STACK PATTERNS AND ALGORITHMS
 // =============================================================================
@@ -694,7 +1191,8 @@ void demonstrate_stack_patterns() {
 void demonstrate_array_stack() {
     cout << "\n=== ARRAY STACK DEMONSTRATION ===" << endl;
     
-    ArrayStack<int> arr_stack(5);
+    // A 4-element inline buffer so the move to the heap shows up
+    ArrayStack<int, 4> arr_stack;
     
     // Push elements
     for (int i = 1; i <= 7; i++) {
@@ -713,6 +1211,23 @@ void demonstrate_array_stack() {
     }
     
     arr_stack.printInfo();
+    
+    cout << "\n--- Inline Buffer, Moves and Emplace ---" << endl;
+    ArrayStack<string> words;
+    words.push("small");
+    words.emplace(3, '!');
+    words.emplace("stacks");
+    cout << "Top element: " << words.top() << endl;
+    cout << "Stack of " << words.size() << " uses the " << (words.isInline() ? "inline" : "heap") << " buffer" << endl;
+    
+    for (int i = 0; i < 20; i++) {
+        words.push("word" + to_string(i));
+    }
+    cout << "Stack of " << words.size() << " uses the " << (words.isInline() ? "inline" : "heap") << " buffer" << endl;
+    
+    ArrayStack<string> moved(std::move(words));
+    cout << "After move: source size " << words.size() << ", destination size " << moved.size()
+         << ", top " << moved.top() << endl;
 }
 
 void demonstrate_linked_stack() {
@@ -761,6 +1276,30 @@ void demonstrate_stack_applications() {
     int result = StackApplications::evaluatePostfix(postfix_expr);
     cout << "Postfix: " << postfix_expr << " = " << result << endl;
     
+    // Expression engine: one pass, any literals, variables, bytecode
+    cout << "\n--- Expression Engine ---" << endl;
+    unordered_map<string, double> vars = {{"x", 4}, {"rate", 0.25}};
+    for (string_view expr : {"12 + 3.5 * (x - 1)", "-2^2 + 2^-1", "100 * (1 + rate)^2 % 7", "1.5e3 / -x"}) {
+        cout << expr << " = " << ExpressionEngine::evaluate(expr, vars) << endl;
+    }
+    
+    CompiledExpression rule = ExpressionEngine::compile("price * qty * (1 - discount) + 2 * 2.5");
+    cout << "Compiled rule: " << rule.instructionCount() << " instructions, variables:";
+    for (const string& name : rule.variables()) cout << " " << name;
+    cout << endl;
+    for (const vector<double>& binding : vector<vector<double>>{{10, 3, 0}, {20, 1, 0.5}, {4.5, 10, 0.1}}) {
+        cout << "  price=" << binding[0] << " qty=" << binding[1] << " discount=" << binding[2]
+             << " -> " << rule.evaluate(binding) << endl;
+    }
+    
+    for (string_view bad : {"2 * (3 + 4", "4 + * 2", "3 $ 2", "7 / y"}) {
+        try {
+            ExpressionEngine::evaluate(bad, vars);
+        } catch (const runtime_error& e) {
+            cout << "\"" << bad << "\": " << e.what() << endl;
+        }
+    }
+    
     // Reverse string
     cout << "\n--- Reverse String ---" << endl;
     string original = "Hello";
@@ -788,6 +1327,75 @@ void demonstrate_stack_applications() {
     cout << "Largest rectangle area: " << max_area << endl;
 }
 
+// Times the same expressions through the postfix string round trip, the
+// single-pass evaluator and compiled bytecode
+void benchmark_expression_engine() {
+    cout << "\n=== EXPRESSION ENGINE BENCHMARK ===" << endl;
+    const int iterations = 1000000;
+    auto elapsed_ns = [&](chrono::steady_clock::time_point since) {
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - since).count() / iterations;
+    };
+    
+    // Single-digit operands, the only form evaluatePostfix understands
+    string digits = "2*3+4*5-6";
+    double postfix_sum = 0, streaming_sum = 0, compiled_sum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        postfix_sum += StackApplications::evaluatePostfix(StackApplications::infixToPostfix(digits));
+    }
+    double postfix_ns = elapsed_ns(start);
+    
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        streaming_sum += ExpressionEngine::evaluate(digits);
+    }
+    double streaming_ns = elapsed_ns(start);
+    
+    CompiledExpression compiled = ExpressionEngine::compile(digits);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        compiled_sum += compiled.evaluate(nullptr);
+    }
+    double compiled_ns = elapsed_ns(start);
+    bool match = postfix_sum == streaming_sum && streaming_sum == compiled_sum;
+    
+    int folded = compiled.instructionCount();
+    cout << digits << " (folds to " << folded << " instruction" << (folded == 1 ? "" : "s") << "):" << endl;
+    cout << "  infixToPostfix + evaluatePostfix: " << postfix_ns << " ns" << endl;
+    cout << "  Single-pass evaluate:             " << streaming_ns << " ns" << endl;
+    cout << "  Compiled bytecode:                " << compiled_ns << " ns" << endl;
+    
+    // A rule re-evaluated with a new binding each time
+    string_view rule_text = "price * qty * (1 - discount) + shipping";
+    unordered_map<string, double> bindings = {{"price", 0}, {"qty", 3}, {"discount", 0.1}, {"shipping", 4.99}};
+    double reparsed_sum = 0, rule_sum = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        bindings["price"] = i % 100;
+        reparsed_sum += ExpressionEngine::evaluate(rule_text, bindings);
+    }
+    double reparsed_ns = elapsed_ns(start);
+    
+    CompiledExpression rule = ExpressionEngine::compile(rule_text);
+    vector<double> values(rule.variables().size());
+    for (size_t v = 0; v < values.size(); v++) {
+        values[v] = bindings[rule.variables()[v]];
+    }
+    int price_slot = rule.slotOf("price");
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        values[price_slot] = i % 100;
+        rule_sum += rule.evaluate(values.data());
+    }
+    double rule_ns = elapsed_ns(start);
+    
+    cout << rule_text << " with " << iterations << " bindings:" << endl;
+    cout << "  Parse and evaluate each time:     " << reparsed_ns << " ns" << endl;
+    cout << "  Compiled bytecode:                " << rule_ns << " ns ("
+         << reparsed_ns / rule_ns << "x)" << endl;
+    cout << "  Results " << (match && reparsed_sum == rule_sum ? "match" : "DIFFER") << endl;
+}
+
 // =============================================================================
 // MAIN FUNCTION
 // =============================================================================
@@ -800,12 +1408,14 @@ int main() {
     demonstrate_stl_stack();
     demonstrate_stack_applications();
     demonstrate_stack_patterns();
+    benchmark_expression_engine();
     
     cout << "\n=== SUMMARY ===" << endl;
     cout << "1. Array Stack: Fast access, fixed/resizable capacity" << endl;
     cout << "2. Linked Stack: Dynamic size, extra memory for pointers" << endl;
     cout << "3. STL Stack: Ready-to-use, optimized implementation" << endl;
     cout << "4. Applications: Parentheses, expressions, undo operations" << endl;
+    cout << "   Expression engine: single-pass shunting-yard, reusable bytecode" << endl;
     cout << "5. Patterns: Monotonic stack, two stacks, min stack" << endl;
     
     return 0;